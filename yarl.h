@@ -0,0 +1,71 @@
+// rozhraní pro běh mnoha nezávislých her najednou (bez okna)
+// knihovna se přeloží z main.cpp s definovaným YARL_LIBRARY
+#ifndef YARL_H
+#define YARL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// rozměry bludiště (musí odpovídat MAP_WIDTH a MAP_HEIGHT v main.cpp)
+#define YARL_MAP_WIDTH 80
+#define YARL_MAP_HEIGHT 45
+
+// pozorování jedné hry: YARL_MAP_WIDTH*YARL_MAP_HEIGHT bajtů bludiště po řádcích
+// (políčko (x,y) je na indexu y*YARL_MAP_WIDTH + x), pak hp a max_hp hráče (oříznuté na 0..255)
+#define YARL_OBS_SIZE (YARL_MAP_WIDTH*YARL_MAP_HEIGHT + 2)
+
+// dolní tři bity políčka - terén
+#define YARL_CELL_UNKNOWN 0 // hráč políčko ještě neviděl
+#define YARL_CELL_WALL 1
+#define YARL_CELL_FLOOR 2
+// bit viditelnosti
+#define YARL_CELL_VISIBLE 0x08
+// horní čtyři bity - nejvyšší viditelná entita na políčku
+#define YARL_CELL_PLAYER 0x10
+#define YARL_CELL_MONSTER 0x20
+#define YARL_CELL_ITEM 0x30
+#define YARL_CELL_CORPSE 0x40
+
+// akce hráče
+enum {
+	YARL_ACTION_UP, YARL_ACTION_DOWN, YARL_ACTION_LEFT, YARL_ACTION_RIGHT, // pohyb/útok
+	YARL_ACTION_GRAB, // sebrat předmět
+	YARL_ACTION_HEAL, // vypít léčivý lektvar z inventáře
+	YARL_NUM_ACTIONS
+};
+
+// odměna: +1 za každou zabitou příšerku, +10 za vítězství, -10 za smrt
+
+typedef struct YarlEnvs YarlEnvs;
+
+// vytvoří n her, i-tá začne se semínkem seeds[i]
+YarlEnvs *yarl_create(int n, const unsigned int *seeds);
+// zruší všechny hry
+void yarl_destroy(YarlEnvs *envs);
+// zapíše pozorování všech her do obs (n*YARL_OBS_SIZE bajtů)
+void yarl_observe(YarlEnvs *envs, unsigned char *obs);
+// provede akci actions[i] v i-té hře; hry, které skončily, se hned začnou znovu se
+// semínkem reset_seeds[i] a obs pak obsahuje první pozorování nové hry
+// obs má n*YARL_OBS_SIZE bajtů, rewards a dones po n prvcích
+void yarl_step(YarlEnvs *envs, const int *actions, const unsigned int *reset_seeds,
+	unsigned char *obs, float *rewards, unsigned char *dones);
+// zapíše do hashes (n prvků) hash stavu každé hry; stejné semínko a stejné akce
+// dají stejný hash, takže se tím dá ověřit, že se dva běhy nerozešly
+void yarl_hash(YarlEnvs *envs, unsigned long long *hashes);
+
+typedef struct YarlFork YarlFork;
+
+// zapamatuje stav i-té hry (bludiště se s hrou sdílí po sloupcích, větev je levná)
+YarlFork *yarl_fork(YarlEnvs *envs, int i);
+// vrátí i-tou hru do stavu větve; větev se nezmění, takže jde obnovit znovu
+// a klidně i do jiné hry z téhož yarl_create
+void yarl_restore(YarlEnvs *envs, int i, YarlFork *fork);
+// zruší větev
+void yarl_fork_free(YarlFork *fork);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif